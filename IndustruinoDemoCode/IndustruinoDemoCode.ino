@@ -0,0 +1,65 @@
+/*
+* Industruino Demo Code - Default code loaded onto Industruino
+*
+* Copyright (c) 2013 Loic De Buck <connect@industruino.com>
+*
+* Industruino is a DIN-rail mountable Arduino Leonardo compatible product
+* Please visit www.industruino.com for further information and code examples.
+* Standard peripherals connected to Industruino are:
+* UC1701 compatible LCD; rst:D19 dc:D20 dn:D21 sclk:D22 (set pin configuration in UC1701 library header)
+* 3-button membrane panel; D23, D24, D25 (32u4: one analog pin A5)
+*
+* One sketch for the 32u4, 1286 and D21G boards, the board is selected in board.h
+* The menus are tables in flash (demo-menus.h), run by a small menu engine (menu.h)
+*/
+#include "board.h"
+#include <Indio.h>
+#include <Wire.h>
+
+#include <UC1701.h>
+//Download libary from https://github.com/Industruino/
+
+static UC1701 lcd;
+
+#include "menu.h"
+#include "demo-menus.h"
+
+void setup() {
+
+  Indio.analogWriteMode(1, mA);
+  Indio.analogWriteMode(2, mA);
+  Indio.analogWrite(1, 0, true);
+  Indio.analogWrite(2, 0, true);
+
+  protoInputs(); //Sets all general pins to input
+  buttonsBegin();
+
+#if HAS_EEPROM
+  backlightIntensity = constrain(EEPROM.read(0), 0, 5); //loads the backlight intensity from EEPROM, 0xFF if never saved
+#else
+  backlightIntensity = backlightDefault;
+#endif
+  pinMode(backlightPin, OUTPUT); //set backlight pin to output
+  backlightApply();
+
+  //LCD init
+  lcd.begin();
+  lcd.clear();
+
+  //debug
+  DebugSerial.begin(9600); //enables port for debugging messages
+
+  //Menu init
+  menuOpen(MENU_WELCOME); //load first menu
+}
+
+/*
+* The loop function only runs the menu engine: it checks the buttons, moves the cursor, opens menus,
+* calls the item functions and redraws the live values. It never waits, so your own code can run here too.
+* To make your own menus, see demo-menus.h
+*/
+
+void loop() {
+
+  menuPoll(); //check buttons, update menus and perform actions
+}
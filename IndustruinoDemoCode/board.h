@@ -0,0 +1,98 @@
+/*
+  Board configuration for the Industruino demo code
+  the board is detected from the compiler defines of the selected board in the IDE:
+
+    32u4    Industruino PROTO/IND.I/O with ATmega32u4, buttons on one analog pin
+    1286    Industruino PROTO/IND.I/O with AT90USB1286, buttons on D23-D25
+    D21G    Industruino PROTO/IND.I/O with SAMD21G, buttons on D23-D25, no EEPROM
+
+  everything else in the demo code is the same for the 3 boards
+*/
+
+#if defined(__AVR_ATmega32U4__)
+
+#define BOARD_NAME "32u4"
+#define DebugSerial Serial
+#define HAS_EEPROM 1
+const int backlightPin = 13;          // PWM output pin that the LED backlight is attached to
+const int buttonsAnalogPin = A5;      // the 3 buttons are on one analog pin with a resistor ladder
+const int backlightDefault = 0;       // default LCD backlight intensity 0-5
+#define BACKLIGHT_PWM(level) map(level, 0, 5, 255, 0)
+#define PROTO_ANALOG_FIRST 6          // A0 and A6-A9 on the PROTO analog menu
+
+#elif defined(__AVR_AT90USB1286__)
+
+#define BOARD_NAME "1286"
+#define DebugSerial Serial
+#define HAS_EEPROM 1
+const int backlightPin = 26;          // PWM output pin that the LED backlight is attached to
+const int buttonEnterPin = 24;
+const int buttonUpPin = 25;
+const int buttonDownPin = 23;
+const int backlightDefault = 0;       // default LCD backlight intensity 0-5
+#define BACKLIGHT_PWM(level) map(level, 0, 5, 255, 0)
+#define PROTO_ANALOG_FIRST 10         // A0 and A10-A13 on the PROTO analog menu
+
+#elif defined(ARDUINO_ARCH_SAMD)
+
+#define BOARD_NAME "D21G"
+#define DebugSerial SerialUSB
+#define HAS_EEPROM 0
+const int backlightPin = 26;          // PWM output pin that the LED backlight is attached to
+const int buttonEnterPin = 24;
+const int buttonUpPin = 25;
+const int buttonDownPin = 23;
+const int backlightDefault = 5;       // default LCD backlight intensity 0-5
+#define BACKLIGHT_PWM(level) map(level, 5, 0, 255, 0)
+#define PROTO_ANALOG_FIRST 10         // A0 and A10-A13 on the PROTO analog menu
+
+#else
+#error "Industruino demo code: select an Industruino 32u4, 1286 or D21G board"
+#endif
+
+#if HAS_EEPROM
+#include <EEPROM.h>
+#endif
+
+// the flash helpers are available on all 3 boards, on the D21G flash data is read like RAM
+#include <avr/pgmspace.h>
+
+// button bits returned by buttonsRaw()
+#define BUTTON_UP 0x01
+#define BUTTON_DOWN 0x02
+#define BUTTON_ENTER 0x04
+
+/////////////////////////////////////////////////////////////////////////
+// read the membrane panel, returns the pressed buttons (not debounced)
+
+#if defined(__AVR_ATmega32U4__)
+
+void buttonsBegin() {
+  pinMode(buttonsAnalogPin, INPUT);
+}
+
+byte buttonsRaw() {
+  int value = analogRead(buttonsAnalogPin);
+  if (value > 220 && value < 270) return BUTTON_UP;
+  if (value > 480 && value < 520) return BUTTON_ENTER;
+  if (value > 750 && value < 780) return BUTTON_DOWN;
+  return 0;
+}
+
+#else
+
+void buttonsBegin() {
+  pinMode(buttonEnterPin, INPUT);  // membrane button pins have pull-up resistor
+  pinMode(buttonUpPin, INPUT);
+  pinMode(buttonDownPin, INPUT);
+}
+
+byte buttonsRaw() {
+  byte pressed = 0;
+  if (!digitalRead(buttonUpPin)) pressed |= BUTTON_UP;  // LOW when pressed
+  if (!digitalRead(buttonDownPin)) pressed |= BUTTON_DOWN;
+  if (!digitalRead(buttonEnterPin)) pressed |= BUTTON_ENTER;
+  return pressed;
+}
+
+#endif
@@ -0,0 +1,403 @@
+/*
+  Demo menus for the Industruino demo code
+  to make your own menus:
+  1. add an id to the enum below and a table of items (labels first, they must be in flash too)
+  2. add the table to menus[] at the position of its id with MENU(), the build fails if the count differs
+  3. write the item functions for actions, live values and edited values
+*/
+
+enum {
+  MENU_WELCOME,
+  MENU_SELECT,
+  MENU_PROTO,
+  MENU_PROTO_DOUT,
+  MENU_PROTO_DIN,
+  MENU_PROTO_AIN,
+  MENU_IND,
+  MENU_IND_DIN,
+  MENU_IND_DOUT,
+  MENU_IND_AIN_10V,
+  MENU_IND_AIN_20MA,
+  MENU_IND_AOUT_10V,
+  MENU_IND_AOUT_20MA,
+  MENU_SETUP,
+  MENU_RESET,
+  MENU_COUNT  // number of menus, keep last
+};
+
+// demo state
+int backlightIntensity;                    // LCD backlight intensity 0-5
+float anOut[3] = { 0 };                    // analog outputs ch1-2
+float anOutUpLimit;                        // 10.5V or 20.5mA
+const char *indioUnit;                     // unit of the analog channels, in flash
+
+// PROTO general pins D0-D12, D14-D17
+const byte protoPins[] PROGMEM = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17 };
+
+/////////////////////////////////////////////////////////////////////////
+// labels
+
+const char txtEmpty[] PROGMEM = "";
+const char txtBack[] PROGMEM = "Back";
+const char txtV[] PROGMEM = "V";
+const char txtmA[] PROGMEM = "mA";
+
+const char txtWelcome1[] PROGMEM = "Welcome to";
+const char txtWelcome2[] PROGMEM = "Industruino!";
+const char txtSelect1[] PROGMEM = "Please select";
+const char txtSelect2[] PROGMEM = "Baseboard type:";
+const char txtIndio[] PROGMEM = "IND.I/O";
+const char txtProto[] PROGMEM = "PROTO";
+
+const char txtDigitalOut[] PROGMEM = "DigitalOut";
+const char txtDigitalIn[] PROGMEM = "DigitalIn";
+const char txtAnalogIn[] PROGMEM = "AnalogIn";
+
+const char txtIndDin[] PROGMEM = "Digital Input";
+const char txtIndDout[] PROGMEM = "Digital Output";
+const char txtIndAin10V[] PROGMEM = "Analog Input  0-10V";
+const char txtIndAin20mA[] PROGMEM = "Analog Input  0-20mA";
+const char txtIndAout10V[] PROGMEM = "Analog Output 0-10V";
+const char txtIndAout20mA[] PROGMEM = "Analog Output 0-20mA";
+const char txtBacklightMenu[] PROGMEM = "LCD backlight";
+
+const char txtBacklight[] PROGMEM = "BackLight";
+const char txtResetParam[] PROGMEM = "Reset param.";
+const char txtReset1[] PROGMEM = "Set system";
+const char txtReset2[] PROGMEM = "to default";
+const char txtReset3[] PROGMEM = "settings?";
+const char txtOK[] PROGMEM = "OK?";
+const char txtCancel[] PROGMEM = "Cancel";
+
+const char txtCH1[] PROGMEM = "CH1";
+const char txtCH2[] PROGMEM = "CH2";
+const char txtCH3[] PROGMEM = "CH3";
+const char txtCH4[] PROGMEM = "CH4";
+const char txtCH5[] PROGMEM = "CH5";
+const char txtCH6[] PROGMEM = "CH6";
+const char txtCH7[] PROGMEM = "CH7";
+const char txtCH8[] PROGMEM = "CH8";
+
+const char txtD0[] PROGMEM = "D0";
+const char txtD1[] PROGMEM = "D1";
+const char txtD2[] PROGMEM = "D2";
+const char txtD3[] PROGMEM = "D3";
+const char txtD4[] PROGMEM = "D4";
+const char txtD5[] PROGMEM = "D5";
+const char txtD6[] PROGMEM = "D6";
+const char txtD7[] PROGMEM = "D7";
+const char txtD8[] PROGMEM = "D8";
+const char txtD9[] PROGMEM = "D9";
+const char txtD10[] PROGMEM = "D10";
+const char txtD11[] PROGMEM = "D11";
+const char txtD12[] PROGMEM = "D12";
+const char txtD14[] PROGMEM = "D14";
+const char txtD15[] PROGMEM = "D15";
+const char txtD16[] PROGMEM = "D16";
+const char txtD17[] PROGMEM = "D17";
+
+const char txtA0[] PROGMEM = "A0";
+#if PROTO_ANALOG_FIRST == 6
+const char txtAn1[] PROGMEM = "A6";
+const char txtAn2[] PROGMEM = "A7";
+const char txtAn3[] PROGMEM = "A8";
+const char txtAn4[] PROGMEM = "A9";
+#else
+const char txtAn1[] PROGMEM = "A10";
+const char txtAn2[] PROGMEM = "A11";
+const char txtAn3[] PROGMEM = "A12";
+const char txtAn4[] PROGMEM = "A13";
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+// menu open functions
+
+void protoOutputs() {
+  for (byte i = 0; i < sizeof(protoPins); i++) pinMode(pgm_read_byte(&protoPins[i]), OUTPUT);
+}
+
+void protoInputs() {
+  for (byte i = 0; i < sizeof(protoPins); i++) pinMode(pgm_read_byte(&protoPins[i]), INPUT);
+}
+
+void indioInputs() {
+  for (int i = 1; i <= 8; i++) {
+    Indio.digitalMode(i, INPUT);
+    Indio.digitalWrite(i, LOW);
+  }
+}
+
+void indioOutputs() {
+  for (int i = 1; i <= 8; i++) {
+    Indio.digitalMode(i, OUTPUT);
+    Indio.digitalWrite(i, LOW);
+  }
+}
+
+void indioAnalogIn(int mode) {
+  Indio.setADCResolution(14);
+  for (int i = 1; i <= 4; i++) Indio.analogReadMode(i, mode);
+}
+
+void indioAnalogIn10V() {
+  indioUnit = txtV;
+  indioAnalogIn(V10);
+}
+
+void indioAnalogIn20mA() {
+  indioUnit = txtmA;
+  indioAnalogIn(mA);
+}
+
+void indioAnalogOut(int mode) {
+  anOut[1] = 0;
+  anOut[2] = 0;
+  for (int i = 1; i <= 2; i++) {
+    Indio.analogWriteMode(i, mode);
+    Indio.analogWrite(i, 0, false);
+  }
+}
+
+void indioAnalogOut10V() {
+  indioUnit = txtV;
+  anOutUpLimit = 10.5;
+  indioAnalogOut(V10);
+}
+
+void indioAnalogOut20mA() {
+  indioUnit = txtmA;
+  anOutUpLimit = 20.5;
+  indioAnalogOut(mA);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// item functions
+
+void protoDigitalHold(byte pin, byte event) {
+  digitalWrite(pin, event == EVENT_ENTER ? HIGH : LOW);  // output HIGH while ENTER is held
+}
+
+void protoDigitalShow(byte pin, byte event) {
+  lcd.print(digitalRead(pin));
+}
+
+void protoAnalogShow(byte pin, byte event) {
+  lcd.print(analogRead(pin));
+}
+
+void indioDigitalHold(byte ch, byte event) {
+  Indio.digitalWrite(ch, event == EVENT_ENTER ? HIGH : LOW);  // output HIGH while ENTER is held
+}
+
+void indioDigitalShow(byte ch, byte event) {
+  lcd.print(Indio.digitalRead(ch));
+}
+
+void indioAnalogShow(byte ch, byte event) {
+  lcd.print(Indio.analogRead(ch));
+  lcd.print((const __FlashStringHelper *)indioUnit);
+}
+
+void indioAnalogEdit(byte ch, byte event) {
+  if (event == EVENT_UP && anOut[ch] <= anOutUpLimit - 0.5) anOut[ch] += 0.5;
+  if (event == EVENT_DOWN && anOut[ch] > 0) anOut[ch] -= 0.5;
+  if (event == EVENT_UP || event == EVENT_DOWN) {
+    Indio.analogWrite(ch, anOut[ch], false);
+    DebugSerial.println(anOut[ch]);
+  }
+  if (event == EVENT_SHOW) {
+    lcd.print(anOut[ch], 2);
+    lcd.print((const __FlashStringHelper *)indioUnit);
+  }
+}
+
+void indioAnalogBack(byte arg, byte event) {  // outputs to 0mA when leaving the menu
+  for (int i = 1; i <= 2; i++) {
+    Indio.analogWriteMode(i, mA);
+    Indio.analogWrite(i, 0, false);
+  }
+  menuOpen(MENU_IND);
+}
+
+void backlightApply() {
+  analogWrite(backlightPin, BACKLIGHT_PWM(backlightIntensity));
+}
+
+void backlightEdit(byte arg, byte event) {
+  if (event == EVENT_UP && backlightIntensity < 5) backlightIntensity++;
+  if (event == EVENT_DOWN && backlightIntensity > 0) backlightIntensity--;
+  if (event == EVENT_UP || event == EVENT_DOWN) backlightApply();
+  if (event == EVENT_SHOW) lcd.print(backlightIntensity);
+#if HAS_EEPROM
+  if (event == EVENT_ENTER) EEPROM.update(0, backlightIntensity);  // save when editing is done
+#endif
+}
+
+void resetParameters(byte arg, byte event) {  // resets the setup parameters and saves them to EEPROM
+  backlightIntensity = backlightDefault;
+  backlightApply();
+#if HAS_EEPROM
+  EEPROM.update(0, backlightIntensity);
+#endif
+  menuOpen(MENU_SETUP);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// menu tables
+
+const MenuItem itemsWelcome[] PROGMEM = {
+  { txtEmpty, ITEM_TEXT, 0, NULL },
+  { txtWelcome1, ITEM_TEXT, 0, NULL },
+  { txtWelcome2, ITEM_TEXT, 0, NULL },
+};
+
+const MenuItem itemsSelect[] PROGMEM = {
+  { txtSelect1, ITEM_TEXT, 0, NULL },
+  { txtSelect2, ITEM_TEXT, 0, NULL },
+  { txtEmpty, ITEM_TEXT, 0, NULL },
+  { txtIndio, ITEM_MENU, MENU_IND, NULL },
+  { txtProto, ITEM_MENU, MENU_PROTO, NULL },
+};
+
+const MenuItem itemsProto[] PROGMEM = {
+  { txtDigitalOut, ITEM_MENU, MENU_PROTO_DOUT, NULL },
+  { txtDigitalIn, ITEM_MENU, MENU_PROTO_DIN, NULL },
+  { txtAnalogIn, ITEM_MENU, MENU_PROTO_AIN, NULL },
+  { txtBack, ITEM_MENU, MENU_SELECT, NULL },
+};
+
+const MenuItem itemsProtoDout[] PROGMEM = {
+  { txtD0, ITEM_HOLD, 0, protoDigitalHold },
+  { txtD1, ITEM_HOLD, 1, protoDigitalHold },
+  { txtD2, ITEM_HOLD, 2, protoDigitalHold },
+  { txtD3, ITEM_HOLD, 3, protoDigitalHold },
+  { txtD4, ITEM_HOLD, 4, protoDigitalHold },
+  { txtD5, ITEM_HOLD, 5, protoDigitalHold },
+  { txtD6, ITEM_HOLD, 6, protoDigitalHold },
+  { txtD7, ITEM_HOLD, 7, protoDigitalHold },
+  { txtD8, ITEM_HOLD, 8, protoDigitalHold },
+  { txtD9, ITEM_HOLD, 9, protoDigitalHold },
+  { txtD10, ITEM_HOLD, 10, protoDigitalHold },
+  { txtD11, ITEM_HOLD, 11, protoDigitalHold },
+  { txtD12, ITEM_HOLD, 12, protoDigitalHold },
+  { txtD14, ITEM_HOLD, 14, protoDigitalHold },
+  { txtD15, ITEM_HOLD, 15, protoDigitalHold },
+  { txtD16, ITEM_HOLD, 16, protoDigitalHold },
+  { txtD17, ITEM_HOLD, 17, protoDigitalHold },
+  { txtBack, ITEM_MENU, MENU_PROTO, NULL },
+};
+
+const MenuItem itemsProtoDin[] PROGMEM = {
+  { txtD0, ITEM_LIVE, 0, protoDigitalShow },
+  { txtD1, ITEM_LIVE, 1, protoDigitalShow },
+  { txtD2, ITEM_LIVE, 2, protoDigitalShow },
+  { txtD3, ITEM_LIVE, 3, protoDigitalShow },
+  { txtD4, ITEM_LIVE, 4, protoDigitalShow },
+  { txtD5, ITEM_LIVE, 5, protoDigitalShow },
+  { txtD6, ITEM_LIVE, 6, protoDigitalShow },
+  { txtD7, ITEM_LIVE, 7, protoDigitalShow },
+  { txtD8, ITEM_LIVE, 8, protoDigitalShow },
+  { txtD9, ITEM_LIVE, 9, protoDigitalShow },
+  { txtD10, ITEM_LIVE, 10, protoDigitalShow },
+  { txtD11, ITEM_LIVE, 11, protoDigitalShow },
+  { txtD12, ITEM_LIVE, 12, protoDigitalShow },
+  { txtD14, ITEM_LIVE, 14, protoDigitalShow },
+  { txtD15, ITEM_LIVE, 15, protoDigitalShow },
+  { txtD16, ITEM_LIVE, 16, protoDigitalShow },
+  { txtD17, ITEM_LIVE, 17, protoDigitalShow },
+  { txtBack, ITEM_MENU, MENU_PROTO, NULL },
+};
+
+const MenuItem itemsProtoAin[] PROGMEM = {
+  { txtA0, ITEM_LIVE, 0, protoAnalogShow },
+  { txtAn1, ITEM_LIVE, PROTO_ANALOG_FIRST, protoAnalogShow },
+  { txtAn2, ITEM_LIVE, PROTO_ANALOG_FIRST + 1, protoAnalogShow },
+  { txtAn3, ITEM_LIVE, PROTO_ANALOG_FIRST + 2, protoAnalogShow },
+  { txtAn4, ITEM_LIVE, PROTO_ANALOG_FIRST + 3, protoAnalogShow },
+  { txtBack, ITEM_MENU, MENU_PROTO, NULL },
+};
+
+const MenuItem itemsInd[] PROGMEM = {
+  { txtIndDin, ITEM_MENU, MENU_IND_DIN, NULL },
+  { txtIndDout, ITEM_MENU, MENU_IND_DOUT, NULL },
+  { txtIndAin10V, ITEM_MENU, MENU_IND_AIN_10V, NULL },
+  { txtIndAin20mA, ITEM_MENU, MENU_IND_AIN_20MA, NULL },
+  { txtIndAout10V, ITEM_MENU, MENU_IND_AOUT_10V, NULL },
+  { txtIndAout20mA, ITEM_MENU, MENU_IND_AOUT_20MA, NULL },
+  { txtBacklightMenu, ITEM_MENU, MENU_SETUP, NULL },
+  { txtBack, ITEM_MENU, MENU_SELECT, NULL },
+};
+
+const MenuItem itemsIndDin[] PROGMEM = {
+  { txtCH1, ITEM_LIVE, 1, indioDigitalShow },
+  { txtCH2, ITEM_LIVE, 2, indioDigitalShow },
+  { txtCH3, ITEM_LIVE, 3, indioDigitalShow },
+  { txtCH4, ITEM_LIVE, 4, indioDigitalShow },
+  { txtCH5, ITEM_LIVE, 5, indioDigitalShow },
+  { txtCH6, ITEM_LIVE, 6, indioDigitalShow },
+  { txtCH7, ITEM_LIVE, 7, indioDigitalShow },
+  { txtCH8, ITEM_LIVE, 8, indioDigitalShow },
+  { txtBack, ITEM_MENU, MENU_IND, NULL },
+};
+
+const MenuItem itemsIndDout[] PROGMEM = {
+  { txtCH1, ITEM_HOLD, 1, indioDigitalHold },
+  { txtCH2, ITEM_HOLD, 2, indioDigitalHold },
+  { txtCH3, ITEM_HOLD, 3, indioDigitalHold },
+  { txtCH4, ITEM_HOLD, 4, indioDigitalHold },
+  { txtCH5, ITEM_HOLD, 5, indioDigitalHold },
+  { txtCH6, ITEM_HOLD, 6, indioDigitalHold },
+  { txtCH7, ITEM_HOLD, 7, indioDigitalHold },
+  { txtCH8, ITEM_HOLD, 8, indioDigitalHold },
+  { txtBack, ITEM_MENU, MENU_IND, NULL },
+};
+
+// used for 0-10V and 0-20mA, the unit is set when the menu is opened
+const MenuItem itemsIndAin[] PROGMEM = {
+  { txtCH1, ITEM_LIVE, 1, indioAnalogShow },
+  { txtCH2, ITEM_LIVE, 2, indioAnalogShow },
+  { txtCH3, ITEM_LIVE, 3, indioAnalogShow },
+  { txtCH4, ITEM_LIVE, 4, indioAnalogShow },
+  { txtBack, ITEM_MENU, MENU_IND, NULL },
+};
+
+const MenuItem itemsIndAout[] PROGMEM = {
+  { txtCH1, ITEM_EDIT, 1, indioAnalogEdit },
+  { txtCH2, ITEM_EDIT, 2, indioAnalogEdit },
+  { txtBack, ITEM_ACTION, 0, indioAnalogBack },
+};
+
+const MenuItem itemsSetup[] PROGMEM = {
+  { txtBacklight, ITEM_EDIT, 0, backlightEdit },
+  { txtResetParam, ITEM_MENU, MENU_RESET, NULL },
+  { txtBack, ITEM_MENU, MENU_IND, NULL },
+};
+
+const MenuItem itemsReset[] PROGMEM = {
+  { txtReset1, ITEM_TEXT, 0, NULL },
+  { txtReset2, ITEM_TEXT, 0, NULL },
+  { txtReset3, ITEM_TEXT, 0, NULL },
+  { txtEmpty, ITEM_TEXT, 0, NULL },
+  { txtOK, ITEM_ACTION, 0, resetParameters },
+  { txtCancel, ITEM_MENU, MENU_IND, NULL },
+};
+
+// in the order of the menu ids
+const Menu menus[] PROGMEM = {
+  MENU(itemsWelcome, MENU_SELECT, 0, NULL),
+  MENU(itemsSelect, MENU_SELECT, 0, NULL),
+  MENU(itemsProto, MENU_SELECT, 0, NULL),
+  MENU(itemsProtoDout, MENU_PROTO, 0, protoOutputs),
+  MENU(itemsProtoDin, MENU_PROTO, 300, protoInputs),
+  MENU(itemsProtoAin, MENU_PROTO, 300, protoInputs),
+  MENU(itemsInd, MENU_SELECT, 0, NULL),
+  MENU(itemsIndDin, MENU_IND, 300, indioInputs),
+  MENU(itemsIndDout, MENU_IND, 0, indioOutputs),
+  MENU(itemsIndAin, MENU_IND, 268, indioAnalogIn10V),
+  MENU(itemsIndAin, MENU_IND, 268, indioAnalogIn20mA),
+  MENU(itemsIndAout, MENU_IND, 0, indioAnalogOut10V),
+  MENU(itemsIndAout, MENU_IND, 0, indioAnalogOut20mA),
+  MENU(itemsSetup, MENU_IND, 0, NULL),
+  MENU(itemsReset, MENU_IND, 0, NULL),
+};
+static_assert(sizeof(menus) / sizeof(menus[0]) == MENU_COUNT, "menus[] needs one entry per menu id");
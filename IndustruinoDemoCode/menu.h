@@ -0,0 +1,260 @@
+/*
+  Table-driven menu engine for the Industruino LCD and membrane panel
+
+  a menu is a table of items, all menus are in one table indexed by menu id
+  the tables and the labels are const data in flash (PROGMEM), only the state below is in RAM
+  an item is read from flash when it is needed, with memcpy_P()
+
+  item kinds:
+    ITEM_TEXT    label only, the cursor skips it
+    ITEM_MENU    ENTER opens the menu with id 'arg'
+    ITEM_ACTION  ENTER calls fn(arg, EVENT_ENTER)
+    ITEM_HOLD    fn(arg, EVENT_ENTER) when ENTER is pressed, fn(arg, EVENT_RELEASE) when released
+    ITEM_LIVE    value printed by fn(arg, EVENT_SHOW), redrawn every refresh_ms, the cursor skips it
+    ITEM_EDIT    ENTER starts editing: UP/DOWN call fn(arg, EVENT_UP/EVENT_DOWN), ENTER again calls fn(arg, EVENT_ENTER)
+
+  buttons are debounced and UP/DOWN repeat while held, the engine never waits in a loop
+  call menuOpen() once in setup() and menuPoll() in every loop()
+*/
+
+// layout of the 128x64 LCD: 8 rows of text, cursor in column 0
+const byte MENU_ROWS = 8;
+const byte MENU_LABEL_X = 6;
+const byte MENU_VALUE_X = 66;
+const byte MENU_NONE = 0xFF;
+
+// buttons
+const unsigned int BUTTON_DEBOUNCE_MS = 20;       // raw state must be stable this long
+const unsigned int BUTTON_REPEAT_DELAY_MS = 500;  // UP/DOWN held this long starts repeating
+const unsigned int BUTTON_REPEAT_MS = 150;        // then one event per interval
+
+enum { ITEM_TEXT, ITEM_MENU, ITEM_ACTION, ITEM_HOLD, ITEM_LIVE, ITEM_EDIT };
+enum { EVENT_NONE, EVENT_SHOW, EVENT_ENTER, EVENT_RELEASE, EVENT_UP, EVENT_DOWN };
+
+struct MenuItem {
+  const char *label;                  // in flash
+  byte kind;
+  byte arg;                           // menu id for ITEM_MENU, channel or pin for the others
+  void (*fn)(byte arg, byte event);   // NULL for ITEM_TEXT and ITEM_MENU
+};
+
+struct Menu {
+  const MenuItem *items;              // in flash
+  byte count;
+  byte back;                          // opened by ENTER on a menu without selectable items
+  unsigned int refresh_ms;            // ITEM_LIVE values are redrawn at this interval
+  void (*open)();                     // called when the menu is opened, NULL if not needed
+};
+
+// the item count is taken from the table at compile time
+#define MENU(items, back, refresh_ms, open) \
+  { items, sizeof(items) / sizeof(items[0]), back, refresh_ms, open }
+
+extern const Menu menus[] PROGMEM;    // defined with the demo menus
+
+// menu state
+Menu menu_current;                    // copy of the open menu from flash
+byte menu_sel;                        // selected item, MENU_NONE if nothing can be selected
+byte menu_top;                        // first item on the screen
+bool menu_editing;
+bool menu_holding;
+unsigned long menu_refresh_ts;
+
+// button state
+byte button_raw_last;
+byte button_stable;
+unsigned long button_change_ts;
+unsigned long button_repeat_ts;
+
+/////////////////////////////////////////////////////////////////////////
+// debounce the buttons and turn them into one event per call
+
+byte buttonsPoll() {
+
+  byte raw = buttonsRaw();
+  unsigned long now = millis();
+
+  if (raw != button_raw_last) {
+    button_raw_last = raw;
+    button_change_ts = now;
+    return EVENT_NONE;
+  }
+  if (now - button_change_ts < BUTTON_DEBOUNCE_MS) return EVENT_NONE;
+
+  // stable for long enough: report one change, others follow on the next calls
+  byte changed = raw ^ button_stable;
+  if (changed & BUTTON_ENTER) {
+    button_stable ^= BUTTON_ENTER;
+    return (raw & BUTTON_ENTER) ? EVENT_ENTER : EVENT_RELEASE;
+  }
+  if (changed & (BUTTON_UP | BUTTON_DOWN)) {
+    button_stable = (button_stable & BUTTON_ENTER) | (raw & (BUTTON_UP | BUTTON_DOWN));
+    if (!(changed & raw)) return EVENT_NONE;  // released
+    button_repeat_ts = now + BUTTON_REPEAT_DELAY_MS;
+    return (changed & raw & BUTTON_UP) ? EVENT_UP : EVENT_DOWN;
+  }
+
+  // auto-repeat while UP or DOWN is held
+  if ((button_stable & (BUTTON_UP | BUTTON_DOWN)) && (long)(now - button_repeat_ts) >= 0) {
+    button_repeat_ts = now + BUTTON_REPEAT_MS;
+    return (button_stable & BUTTON_UP) ? EVENT_UP : EVENT_DOWN;
+  }
+  return EVENT_NONE;
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+void menuItem(byte index, MenuItem &item) {
+  memcpy_P(&item, &menu_current.items[index], sizeof(MenuItem));
+}
+
+bool menuSelectable(byte index) {
+  MenuItem item;
+  menuItem(index, item);
+  return item.kind != ITEM_TEXT && item.kind != ITEM_LIVE;
+}
+
+// next selectable item from 'index' in direction 'dir', MENU_NONE if there is none
+byte menuFind(int index, int dir) {
+  for (; index >= 0 && index < menu_current.count; index += dir) {
+    if (menuSelectable(index)) return index;
+  }
+  return MENU_NONE;
+}
+
+// keep the selected item on the screen, returns true if the screen has scrolled
+bool menuScroll() {
+  byte top = menu_top;
+  if (menu_sel == MENU_NONE) return false;
+  if (menu_sel < menu_top) menu_top = menu_sel;
+  if (menu_sel >= menu_top + MENU_ROWS) menu_top = menu_sel - MENU_ROWS + 1;
+  return top != menu_top;
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+void menuDrawCursor(byte index) {
+  lcd.setCursor(0, index - menu_top);
+  if (index != menu_sel) lcd.print(' ');
+  else if (menu_editing || menu_holding) lcd.print('*');
+  else lcd.print('>');
+}
+
+void menuDrawValue(byte index, MenuItem &item) {
+  lcd.setCursor(MENU_VALUE_X, index - menu_top);
+  item.fn(item.arg, EVENT_SHOW);
+  lcd.print(F("  "));  // clear what is left of a longer value
+}
+
+void menuDraw() {
+  lcd.clear();
+  for (byte i = menu_top; i < menu_current.count && i < menu_top + MENU_ROWS; i++) {
+    MenuItem item;
+    menuItem(i, item);
+    menuDrawCursor(i);
+    lcd.setCursor(MENU_LABEL_X, i - menu_top);
+    lcd.print((const __FlashStringHelper *)item.label);
+    if (item.kind == ITEM_LIVE || item.kind == ITEM_EDIT) menuDrawValue(i, item);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+void menuOpen(byte id) {
+  memcpy_P(&menu_current, &menus[id], sizeof(Menu));
+  menu_editing = false;
+  menu_holding = false;
+  if (menu_current.open) menu_current.open();
+  menu_top = 0;
+  menu_sel = menuFind(0, 1);
+  menuScroll();
+  menuDraw();
+  menu_refresh_ts = millis();
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+void menuMove(int dir) {
+  byte next = menuFind(menu_sel + dir, dir);
+  if (next == MENU_NONE) return;  // already on the first/last selectable item
+  byte prev = menu_sel;
+  menu_sel = next;
+  if (menuScroll()) {
+    menuDraw();
+  } else {
+    menuDrawCursor(prev);
+    menuDrawCursor(next);
+  }
+}
+
+void menuHandle(byte event) {
+
+  if (menu_sel == MENU_NONE) {  // e.g. the splash screen
+    if (event == EVENT_ENTER) menuOpen(menu_current.back);
+    return;
+  }
+
+  MenuItem item;
+  menuItem(menu_sel, item);
+
+  if (menu_editing) {
+    if (event == EVENT_UP || event == EVENT_DOWN) {
+      item.fn(item.arg, event);
+      menuDrawValue(menu_sel, item);
+    } else if (event == EVENT_ENTER) {
+      item.fn(item.arg, EVENT_ENTER);
+      menu_editing = false;
+      menuDrawCursor(menu_sel);
+    }
+    return;
+  }
+
+  if (menu_holding) {
+    if (event == EVENT_RELEASE) {
+      item.fn(item.arg, EVENT_RELEASE);
+      menu_holding = false;
+      menuDrawCursor(menu_sel);
+    }
+    return;
+  }
+
+  if (event == EVENT_UP) menuMove(-1);
+  if (event == EVENT_DOWN) menuMove(1);
+  if (event != EVENT_ENTER) return;
+
+  switch (item.kind) {
+    case ITEM_MENU:
+      menuOpen(item.arg);
+      break;
+    case ITEM_ACTION:
+      item.fn(item.arg, EVENT_ENTER);  // may open another menu
+      break;
+    case ITEM_HOLD:
+      item.fn(item.arg, EVENT_ENTER);
+      menu_holding = true;
+      menuDrawCursor(menu_sel);
+      break;
+    case ITEM_EDIT:
+      menu_editing = true;
+      menuDrawCursor(menu_sel);
+      break;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////
+// call from loop(): handles one button event and redraws live values at interval
+
+void menuPoll() {
+
+  byte event = buttonsPoll();
+  if (event != EVENT_NONE) menuHandle(event);
+
+  if (menu_current.refresh_ms && millis() - menu_refresh_ts > menu_current.refresh_ms) {
+    for (byte i = menu_top; i < menu_current.count && i < menu_top + MENU_ROWS; i++) {
+      MenuItem item;
+      menuItem(i, item);
+      if (item.kind == ITEM_LIVE) menuDrawValue(i, item);
+    }
+    menu_refresh_ts = millis();
+  }
+}
@@ -0,0 +1,58 @@
+#!/bin/bash
+# Industruino demo code size report
+# this script takes 3 arguments, the board FQBNs as installed in your arduino-cli:
+# 1. the FQBN of the 32u4 board
+# 2. the FQBN of the 1286 board
+# 3. the FQBN of the D21G board
+# find them with: arduino-cli board listall industruino
+# this script does:
+# > compiles the old IndustruinoDemoCode_32u4/_1286/_D21G sketches, taken from the git history
+# > compiles the new IndustruinoDemoCode sketch for the same 3 boards
+# > prints the flash ("Sketch uses") and RAM ("Global variables") of each, as a table for the README
+# run it from the git repository, arduino-cli needs the Industruino boards and the UC1701 and Indio libraries
+
+if [ $# != 3 ]
+then
+	echo "ERROR: script needs 3 arguments: FQBN of the 32u4, 1286 and D21G boards"
+	exit 1
+fi
+
+cd "$(dirname "$0")"
+BOARDS=(32u4 1286 D21G)
+FQBNS=("$1" "$2" "$3")
+TMP=$(mktemp -d)
+
+# the old sketches were removed by the commit that added this sketch
+REMOVED=$(git rev-list -1 HEAD -- ../IndustruinoDemoCode_32u4)
+(cd .. && git archive "$REMOVED^" IndustruinoDemoCode_32u4 IndustruinoDemoCode_1286 IndustruinoDemoCode_D21G) | tar -x -C $TMP
+
+# prints "flash RAM" in bytes, RAM from the elf file if the core does not report it (SAMD)
+measure() {
+	OUT=$(arduino-cli compile -b "$1" --output-dir "$TMP/build" "$2" 2>&1)
+	if [ $? -ne 0 ]
+	then
+		echo "$OUT" >&2
+		echo "failed failed"
+		return
+	fi
+	FLASH=$(echo "$OUT" | sed -n 's/^Sketch uses \([0-9]*\) bytes.*/\1/p')
+	RAM=$(echo "$OUT" | sed -n 's/^Global variables use \([0-9]*\) bytes.*/\1/p')
+	if [ -z "$RAM" ]
+	then
+		RAM=$(${SIZE:-size} -A "$TMP"/build/*.elf | awk '$1 == ".data" || $1 == ".bss" { ram += $2 } END { print ram }')
+	fi
+	rm -rf "$TMP/build"
+	echo "$FLASH $RAM"
+}
+
+echo "| board | before: flash | before: RAM | after: flash | after: RAM |"
+echo "|-------|--------------:|------------:|-------------:|-----------:|"
+for i in 0 1 2
+do
+	read OLD_FLASH OLD_RAM <<< $(measure "${FQBNS[$i]}" "$TMP/IndustruinoDemoCode_${BOARDS[$i]}")
+	read NEW_FLASH NEW_RAM <<< $(measure "${FQBNS[$i]}" "$PWD")
+	echo "| ${BOARDS[$i]} | $OLD_FLASH bytes | $OLD_RAM bytes | $NEW_FLASH bytes | $NEW_RAM bytes |"
+done
+
+rm -rf $TMP
+exit 0
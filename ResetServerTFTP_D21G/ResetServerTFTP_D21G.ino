@@ -9,6 +9,14 @@
 // authentication method, just a way to differentiate between different boards
 // on the same local network if you need to.
 //
+// Next to the reset server, a status server on port 80 shows the I/O channels,
+// pulse counters, loop timing and the VERSION below, see the status-server tab:
+//
+//    http://{ip}/status     JSON
+//    http://{ip}/metrics    Prometheus text format
+//
+// status_bench.sh measures its response latency (p50/p99) from a computer.
+//
 // Originally created 14 Sep 2012 by Stelios Tsampas
 // Adapted for Industruino by Claudio Indellicati and Tom Tobback
 
@@ -22,6 +30,7 @@
 #include <Wire.h>                               // for RTC EEPROM MAC
 #include <UC1701.h>
 static UC1701 lcd;
+#include <Indio.h>                              // I/O channels for the status server
 
 // Networking parameters for the reset server
 byte mac[6];                                    // read from RTC EEPROM
@@ -35,6 +44,9 @@ char *reset_path = "password";
 // Create the reset server
 EthernetReset reset(port, reset_path);
 
+// status server tab
+#include "status-server.h"
+
 /////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
 
@@ -65,6 +77,15 @@ void setup()
   // need to run
   reset.begin(mac, locIp, dnsIp, gwIp, netMask);
 
+  // I/O channels as used by this sketch: digital ch1-8 as inputs, analog inputs ch1-4 in 0-10V -> 0-100% mode
+  // 12 bit is the fastest ADC conversion (240SPS), the status server waits for one conversion every 250ms
+  for (int i = 1; i <= 8; i++) Indio.digitalMode(i, INPUT);
+  Indio.setADCResolution(12);
+  for (int i = 1; i <= 4; i++) Indio.analogReadMode(i, V10_p);
+
+  // Starting the status server, after the reset server has started Ethernet and the I/O is configured
+  statusBegin();
+
   // Display some data
   lcd.setCursor(0, 3);
   lcd.print("MAC: ");
@@ -90,6 +111,10 @@ void loop()
   // of checking for any reset request
   reset.check();
 
+  // Serve status requests, this returns within about 2ms, or about 5ms when it reads an analog channel (12 bit)
+  statusLoopTick();
+  statusCheck();
+
   // Put the rest of your code here
   lcd.setCursor(100, 6);
   lcd.print(millis() / 1000);
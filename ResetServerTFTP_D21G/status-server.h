@@ -0,0 +1,521 @@
+/*
+  STATUS SERVER for Industruino D21G
+  small HTTP server that runs from loop() next to reset.check()
+
+    http://{ip}/status     JSON
+    http://{ip}/metrics    Prometheus text format
+
+  every call of statusCheck() does a bounded amount of work:
+  > digital inputs ch1-4 are sampled every call for the pulse counters, ch5-8 one per call (round robin)
+  > one section of the snapshot is rendered per call, into a back buffer
+  > when all sections are rendered the back buffer becomes the front buffer
+  > a client request is read and answered in small steps, from the front buffer, until STATUS_BUDGET_US is used
+  so the response is never built while a client is waiting, and the loop timing stays predictable
+
+  worst case: one call per STATUS_ANALOG_INTERVAL_MS reads one analog channel and does nothing else,
+  Indio.analogRead() waits for the ADC conversion, so this call takes the conversion time plus I2C:
+  about 5ms at 12 bit, 18ms at 14 bit, 68ms at 16 bit, 270ms at 18 bit (the Indio default)
+  all other calls return within about STATUS_BUDGET_US, with one wait left in Ethernet2:
+  we only write what fits in the free W5500 TX buffer, so write() does not wait for buffer space,
+  but it still waits for SEND_OK, which comes when the client's TCP window allows the W5500 to send,
+  so a client that stops reading (zero window) can stall one write until the W5500 times out the socket
+
+  pulse counters: a rising edge is counted when a sample sees the input low and the next one high,
+  so pulses are only counted reliably when high and low both last longer than the longest loop period,
+  including the call that reads an analog channel (about 5ms at 12 bit): up to about 70 pulses/s,
+  see indio_loop_period_microseconds for the real loop period
+
+  the channels are read in the mode the sketch has set them, the status server does not configure the I/O
+
+  one client is served at a time, the other connections are accepted in their own W5500 socket and wait there
+  until the current one is done, as long as there are free sockets (8 in total, shared with the reset server)
+  a waiting connection that sends nothing for STATUS_REQUEST_TIMEOUT_MS is closed, to free its socket
+  all text is rendered with integers only (analog values are sent with 2 decimals)
+
+  Library needed:
+  > Ethernet2: started by EthernetReset in setup()
+  > Indio: https://github.com/Industruino/Indio
+*/
+
+#include <Indio.h>
+#include <stdarg.h>
+#include <utility/w5500.h>   // socket status
+#include <utility/socket.h>  // listen, and disconnect()/close() that do not wait like EthernetClient::stop()
+
+/////////////// STATUS SERVER CONFIG PARAMETERS /////////////////////////////////////////////////////
+const int STATUS_PORT = 80;
+const unsigned long STATUS_BUDGET_US = 2000;          // max time spent in statusCheck() per loop
+const unsigned long STATUS_REQUEST_TIMEOUT_MS = 1000;  // drop clients that do not send a full request
+const unsigned long STATUS_LINGER_MS = 50;            // wait for the client to close before we close
+const unsigned long STATUS_CLOSE_TIMEOUT_MS = 1000;   // then wait for the FIN handshake, at most this long
+const unsigned long STATUS_ANALOG_INTERVAL_MS = 250;  // one analog channel per interval, the ADC is slow
+const int STATUS_CHUNK = 256;                         // bytes written to the W5500 per step
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const int STATUS_JSON_SIZE = 768;
+const int STATUS_PROM_SIZE = 2560;
+
+// response latency histogram, upper bounds in ms, last bucket is +Inf
+const int STATUS_HIST_BUCKETS = 10;
+const unsigned int status_hist_le_ms[STATUS_HIST_BUCKETS - 1] = { 1, 2, 5, 10, 20, 50, 100, 200, 500 };
+
+EthernetClient status_client;
+
+// I/O state, sampled incrementally
+bool status_dig_state[9] = { 0 };                // digital ch1-8
+unsigned long status_pulse_counter[5] = { 0 };   // rising edges on digital inputs ch1-4
+long status_ana_in_centi[5] = { 0 };             // analog inputs ch1-4, 0-100% x 100
+byte status_next_dig_ch = 5;                     // round robin ch5-8
+byte status_next_ana_ch = 1;
+unsigned long status_ana_read_ts;
+
+// loop timing statistics
+unsigned long status_loop_count;
+unsigned long status_loop_last_ts;
+unsigned long status_loop_last_us;
+unsigned long status_loop_min_us = 0xFFFFFFFF;
+unsigned long status_loop_max_us;
+unsigned long status_loop_avg_us;                // exponential moving average, 1/16
+
+// http statistics
+unsigned long status_requests;
+unsigned long status_errors;
+unsigned long status_hist[STATUS_HIST_BUCKETS] = { 0 };
+unsigned long status_latency_sum_us;
+
+// double buffered snapshot: front is served, back is being rendered
+char status_json[2][STATUS_JSON_SIZE];
+char status_prom[2][STATUS_PROM_SIZE];
+int status_json_len[2];
+int status_prom_len[2];
+byte status_front = 0;
+byte status_section = 0;
+
+// request state machine
+enum StatusState { STATUS_IDLE, STATUS_READ, STATUS_HEADER, STATUS_BODY, STATUS_CLOSE, STATUS_CLOSING };
+StatusState status_state = STATUS_IDLE;
+byte status_sock;                  // W5500 socket of status_client
+char status_request_line[40];
+byte status_request_len;
+bool status_line_done;
+byte status_newlines;              // consecutive newlines, 2 is the end of the headers
+const char *status_body;
+int status_body_len;
+int status_sent;
+char status_header[128];
+int status_header_len;
+unsigned long status_accept_us;
+unsigned long status_state_ts;
+bool status_waiting[MAX_SOCK_NUM];               // connection seen that has not sent a request yet
+unsigned long status_wait_ts[MAX_SOCK_NUM];     // since when
+
+///////////////////////////////////////////////////////////////////////
+
+void statusAppend(char *buf, int size, int &len, const char *fmt, ...) {
+  if (len >= size - 1) return;   // full, truncate silently
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf + len, size - len, fmt, args);
+  va_end(args);
+  if (n > 0) len += n;
+  if (len > size - 1) len = size - 1;
+}
+
+///////////////////////////////////////////////////////////////////////
+// call at the start of every loop(), keeps the loop timing statistics
+
+void statusLoopTick() {
+  unsigned long now = micros();
+  unsigned long period = now - status_loop_last_ts;
+  status_loop_last_ts = now;
+  status_loop_count++;
+  status_loop_last_us = period;
+  if (period < status_loop_min_us) status_loop_min_us = period;
+  if (period > status_loop_max_us) status_loop_max_us = period;
+  if (status_loop_avg_us == 0) status_loop_avg_us = period;
+  else status_loop_avg_us = status_loop_avg_us - status_loop_avg_us / 16 + period / 16;
+}
+
+///////////////////////////////////////////////////////////////////////
+// digital inputs ch1-4 every call (pulse counters), one of ch5-8 per call, analog at interval
+// returns true after an analog read, that call has used its time waiting for the ADC
+
+bool statusSample() {
+  for (byte ch = 1; ch <= 4; ch++) {
+    bool now_state = Indio.digitalRead(ch);
+    if (now_state && !status_dig_state[ch]) status_pulse_counter[ch]++;  // rising edge
+    status_dig_state[ch] = now_state;
+  }
+  byte ch = status_next_dig_ch;
+  status_dig_state[ch] = Indio.digitalRead(ch);
+  status_next_dig_ch = ch < 8 ? ch + 1 : 5;
+
+  if (millis() - status_ana_read_ts > STATUS_ANALOG_INTERVAL_MS) {
+    ch = status_next_ana_ch;
+    status_ana_in_centi[ch] = (long)(Indio.analogRead(ch) * 100.0 + 0.5);
+    status_next_ana_ch = (ch % 4) + 1;
+    status_ana_read_ts = millis();
+    return true;
+  }
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////
+// p99 in ms from the latency histogram (upper bound of the bucket)
+
+unsigned int statusP99ms() {
+  if (status_requests == 0) return 0;
+  unsigned long target = status_requests - status_requests / 100;  // 99% of the requests
+  unsigned long cumulative = 0;
+  for (int i = 0; i < STATUS_HIST_BUCKETS - 1; i++) {
+    cumulative += status_hist[i];
+    if (cumulative >= target) return status_hist_le_ms[i];
+  }
+  return 0xFFFF;  // above the last bound
+}
+
+///////////////////////////////////////////////////////////////////////
+// render one section of the snapshot into the back buffers
+
+void statusRender() {
+
+  byte back = 1 - status_front;
+  char *j = status_json[back];
+  char *p = status_prom[back];
+  int &jl = status_json_len[back];
+  int &pl = status_prom_len[back];
+
+  switch (status_section) {
+    case 0:  // general
+      jl = 0;
+      pl = 0;
+      statusAppend(j, STATUS_JSON_SIZE, jl, "{\"version\":\"%s\",\"uptime_s\":%lu", VERSION, millis() / 1000);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_info gauge\nindio_info{version=\"%s\"} 1\n", VERSION);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_uptime_seconds gauge\nindio_uptime_seconds %lu\n", millis() / 1000);
+      break;
+    case 1:  // digital channels
+      statusAppend(j, STATUS_JSON_SIZE, jl, ",\"digital\":[");
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_digital_state gauge\n");
+      for (int i = 1; i <= 8; i++) {
+        statusAppend(j, STATUS_JSON_SIZE, jl, i < 8 ? "%d," : "%d]", status_dig_state[i]);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_digital_state{channel=\"%d\"} %d\n", i, status_dig_state[i]);
+      }
+      break;
+    case 2:  // pulse counters
+      statusAppend(j, STATUS_JSON_SIZE, jl, ",\"counters\":[");
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# HELP indio_pulse_count_total rising edges, pulses shorter than the max loop period are missed\n");
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_pulse_count_total counter\n");
+      for (int i = 1; i <= 4; i++) {
+        statusAppend(j, STATUS_JSON_SIZE, jl, i < 4 ? "%lu," : "%lu]", status_pulse_counter[i]);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_pulse_count_total{channel=\"%d\"} %lu\n", i, status_pulse_counter[i]);
+      }
+      break;
+    case 3:  // analog inputs
+      statusAppend(j, STATUS_JSON_SIZE, jl, ",\"analog\":[");
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_analog_percent gauge\n");
+      for (int i = 1; i <= 4; i++) {
+        long v = status_ana_in_centi[i];
+        const char *sign = v < 0 ? "-" : "";
+        if (v < 0) v = -v;
+        statusAppend(j, STATUS_JSON_SIZE, jl, i < 4 ? "%s%ld.%02ld," : "%s%ld.%02ld]", sign, v / 100, v % 100);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_analog_percent{channel=\"%d\"} %s%ld.%02ld\n", i, sign, v / 100, v % 100);
+      }
+      break;
+    case 4:  // loop timing
+      statusAppend(j, STATUS_JSON_SIZE, jl, ",\"loop\":{\"count\":%lu,\"last_us\":%lu,\"min_us\":%lu,\"max_us\":%lu,\"avg_us\":%lu}",
+                   status_loop_count, status_loop_last_us, status_loop_min_us, status_loop_max_us, status_loop_avg_us);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_loop_count_total counter\nindio_loop_count_total %lu\n", status_loop_count);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_loop_period_microseconds gauge\n");
+      statusAppend(p, STATUS_PROM_SIZE, pl, "indio_loop_period_microseconds{stat=\"last\"} %lu\n", status_loop_last_us);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "indio_loop_period_microseconds{stat=\"min\"} %lu\n", status_loop_min_us);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "indio_loop_period_microseconds{stat=\"max\"} %lu\n", status_loop_max_us);
+      statusAppend(p, STATUS_PROM_SIZE, pl, "indio_loop_period_microseconds{stat=\"avg\"} %lu\n", status_loop_avg_us);
+      break;
+    case 5:  // http statistics
+      {
+        statusAppend(j, STATUS_JSON_SIZE, jl, ",\"http\":{\"requests\":%lu,\"errors\":%lu,\"p99_ms\":%u}}",
+                     status_requests, status_errors, statusP99ms());
+        statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_http_errors_total counter\nindio_http_errors_total %lu\n", status_errors);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "# TYPE indio_http_response_seconds histogram\n");
+        unsigned long cumulative = 0;
+        for (int i = 0; i < STATUS_HIST_BUCKETS - 1; i++) {
+          cumulative += status_hist[i];
+          statusAppend(p, STATUS_PROM_SIZE, pl, "indio_http_response_seconds_bucket{le=\"%u.%03u\"} %lu\n",
+                       status_hist_le_ms[i] / 1000, status_hist_le_ms[i] % 1000, cumulative);
+        }
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_http_response_seconds_bucket{le=\"+Inf\"} %lu\n", status_requests);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_http_response_seconds_sum %lu.%06lu\n",
+                     status_latency_sum_us / 1000000, status_latency_sum_us % 1000000);
+        statusAppend(p, STATUS_PROM_SIZE, pl, "indio_http_response_seconds_count %lu\n", status_requests);
+      }
+      break;
+    case 6:  // swap, but not while a response is being sent from the front buffer
+      if (status_state == STATUS_HEADER || status_state == STATUS_BODY) return;
+      status_front = back;
+      status_section = 0;
+      return;
+  }
+  status_section++;
+}
+
+///////////////////////////////////////////////////////////////////////
+// request line is complete: choose the body and prepare the header
+
+void statusPrepareResponse() {
+
+  const char *content_type = "application/json";
+  const char *code = "200 OK";
+  if (strncmp(status_request_line, "GET /metrics", 12) == 0) {
+    content_type = "text/plain; version=0.0.4";
+    status_body = status_prom[status_front];
+    status_body_len = status_prom_len[status_front];
+  } else if (strncmp(status_request_line, "GET / ", 6) == 0 || strncmp(status_request_line, "GET /status", 11) == 0) {
+    status_body = status_json[status_front];
+    status_body_len = status_json_len[status_front];
+  } else {
+    code = "404 Not Found";
+    content_type = "text/plain";
+    status_body = "not found\n";
+    status_body_len = strlen(status_body);
+    status_errors++;
+  }
+  status_header_len = snprintf(status_header, sizeof(status_header),
+                               "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\nConnection: close\r\n\r\n",
+                               code, content_type, status_body_len);
+  status_sent = 0;
+}
+
+///////////////////////////////////////////////////////////////////////
+
+void statusRecordLatency() {
+  unsigned long latency_us = micros() - status_accept_us;
+  int bucket = STATUS_HIST_BUCKETS - 1;
+  for (int i = 0; i < STATUS_HIST_BUCKETS - 1; i++) {
+    if (latency_us <= status_hist_le_ms[i] * 1000UL) {
+      bucket = i;
+      break;
+    }
+  }
+  status_hist[bucket]++;
+  status_latency_sum_us += latency_us;
+  status_requests++;
+}
+
+///////////////////////////////////////////////////////////////////////
+// keep one socket listening on STATUS_PORT, also while a client is being served
+// EthernetServer is not used: its available() calls the blocking stop() on closed clients,
+// and its begin() could take our socket when it is CLOSED but not closed by us yet
+
+void statusListen() {
+  byte free_sock = MAX_SOCK_NUM;
+  for (byte sock = 0; sock < MAX_SOCK_NUM; sock++) {
+    byte sr = EthernetClient(sock).status();
+    if (EthernetClass::_server_port[sock] == STATUS_PORT && sr == SnSR::LISTEN) return;
+    if (sr == SnSR::CLOSED && free_sock == MAX_SOCK_NUM && !(status_state != STATUS_IDLE && sock == status_sock)) free_sock = sock;
+  }
+  if (free_sock == MAX_SOCK_NUM) return;  // all sockets in use, connections are refused until one is free
+  socket(free_sock, SnMR::TCP, STATUS_PORT, 0);
+  listen(free_sock);
+  EthernetClass::_server_port[free_sock] = STATUS_PORT;
+}
+
+///////////////////////////////////////////////////////////////////////
+// free the sockets of waiting connections that send nothing (dead clients, preconnects, scanners)
+// the W5500 keep-alive is off, so without this they would hold their socket forever:
+// closed without a request: our FIN at once, silent for STATUS_REQUEST_TIMEOUT_MS: our FIN,
+// and close() if the FIN handshake does not end within STATUS_CLOSE_TIMEOUT_MS
+
+void statusSweep() {
+  for (byte sock = 0; sock < MAX_SOCK_NUM; sock++) {
+    if (EthernetClass::_server_port[sock] != STATUS_PORT) continue;
+    if (status_state != STATUS_IDLE && sock == status_sock) continue;  // served by the state machine
+    EthernetClient client(sock);
+    byte sr = client.status();
+    if (sr == SnSR::LISTEN || sr == SnSR::CLOSED || client.available()) {
+      status_waiting[sock] = false;  // listening, free, or a request waiting to be served
+      continue;
+    }
+    if (!status_waiting[sock]) {
+      status_waiting[sock] = true;
+      status_wait_ts[sock] = millis();
+    }
+    unsigned long waiting = millis() - status_wait_ts[sock];
+    if (sr == SnSR::CLOSE_WAIT) {
+      disconnect(sock);
+    } else if (sr == SnSR::ESTABLISHED && waiting > STATUS_REQUEST_TIMEOUT_MS) {
+      disconnect(sock);
+      status_errors++;
+    } else if (waiting > STATUS_REQUEST_TIMEOUT_MS + STATUS_CLOSE_TIMEOUT_MS) {
+      close(sock);
+      EthernetClass::_server_port[sock] = 0;
+      status_waiting[sock] = false;
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////
+// next status socket with a request waiting, MAX_SOCK_NUM if none
+
+byte statusFindClient() {
+  for (byte sock = 0; sock < MAX_SOCK_NUM; sock++) {
+    if (EthernetClass::_server_port[sock] != STATUS_PORT) continue;
+    EthernetClient client(sock);
+    byte sr = client.status();
+    if ((sr == SnSR::ESTABLISHED || sr == SnSR::CLOSE_WAIT) && client.available()) return sock;
+  }
+  return MAX_SOCK_NUM;
+}
+
+///////////////////////////////////////////////////////////////////////
+// one step of the request state machine, returns false if there is nothing to do
+
+bool statusServeStep() {
+
+  // the socket is only ours while it has our port, once CLOSED the reset server may take it
+  if (status_state != STATUS_IDLE && EthernetClass::_server_port[status_sock] != STATUS_PORT) {
+    if (status_state != STATUS_CLOSING) status_errors++;
+    status_state = STATUS_IDLE;
+    return true;
+  }
+
+  switch (status_state) {
+
+    case STATUS_IDLE:
+      status_sock = statusFindClient();
+      if (status_sock == MAX_SOCK_NUM) return false;
+      status_client = EthernetClient(status_sock);
+      status_waiting[status_sock] = false;
+      status_accept_us = micros();
+      status_state_ts = millis();
+      status_request_len = 0;
+      status_line_done = false;
+      status_newlines = 0;
+      status_state = STATUS_READ;
+      return true;
+
+    case STATUS_READ:
+      {
+        int n = status_client.available();
+        if (n == 0) {
+          if (!status_client.connected() || millis() - status_state_ts > STATUS_REQUEST_TIMEOUT_MS) {
+            status_errors++;
+            status_state = STATUS_CLOSE;
+            status_state_ts = millis();
+            return true;
+          }
+          return false;
+        }
+        if (n > 64) n = 64;  // bounded work per step
+        while (n--) {
+          char c = status_client.read();
+          // keep the request line only, the headers are skipped
+          if (!status_line_done && status_request_len < sizeof(status_request_line) - 1 && c != '\r' && c != '\n') {
+            status_request_line[status_request_len++] = c;
+            status_request_line[status_request_len] = '\0';
+          }
+          // an empty line ends the headers: count newlines, ignore \r, reset on anything else
+          if (c == '\n') {
+            status_line_done = true;
+            status_newlines++;
+          } else if (c != '\r') {
+            status_newlines = 0;
+          }
+          if (status_newlines == 2) {
+            statusPrepareResponse();
+            status_state = STATUS_HEADER;
+            status_state_ts = millis();
+            return true;
+          }
+        }
+        return true;
+      }
+
+    case STATUS_HEADER:
+    case STATUS_BODY:
+      {
+        // write only what fits in the free TX buffer: send() would wait for space without a timeout
+        if (!status_client.connected() || millis() - status_state_ts > STATUS_REQUEST_TIMEOUT_MS) {
+          status_errors++;  // closed, or not reading for too long
+          status_state = STATUS_CLOSE;
+          status_state_ts = millis();
+          return true;
+        }
+        int free_size = w5500.getTXFreeSize(status_sock);
+        if (status_state == STATUS_HEADER) {
+          if (free_size < status_header_len) return false;
+          status_client.write((const uint8_t *)status_header, status_header_len);
+          status_state = STATUS_BODY;
+          status_state_ts = millis();
+          return true;
+        }
+        int n = status_body_len - status_sent;
+        if (n > STATUS_CHUNK) n = STATUS_CHUNK;
+        if (n > free_size) n = free_size;
+        if (n <= 0 && status_sent < status_body_len) return false;  // TX buffer full, try again next call
+        if (n > 0) status_client.write((const uint8_t *)status_body + status_sent, n);
+        status_sent += n;
+        status_state_ts = millis();
+        if (status_sent >= status_body_len) {
+          statusRecordLatency();
+          status_state = STATUS_CLOSE;
+          status_state_ts = millis();
+        }
+        return true;
+      }
+
+    case STATUS_CLOSE:
+      // the client closes after Content-Length bytes, give it a moment to do so
+      if (status_client.connected() && millis() - status_state_ts < STATUS_LINGER_MS) return false;
+      // send our FIN, EthernetClient::stop() would wait here up to 1s for the socket to close
+      if (status_client.status() != SnSR::CLOSED) disconnect(status_sock);
+      status_state = STATUS_CLOSING;
+      status_state_ts = millis();
+      return true;
+
+    case STATUS_CLOSING:
+      // poll the socket status on later calls, force the close if the client does not answer
+      if (status_client.status() != SnSR::CLOSED && millis() - status_state_ts < STATUS_CLOSE_TIMEOUT_MS) return false;
+      close(status_sock);
+      EthernetClass::_server_port[status_sock] = 0;  // free the socket, like stop()
+      status_state = STATUS_IDLE;
+      return true;
+  }
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////
+// call in setup() after reset.begin(), the Ethernet module is started by then
+// and after the I/O channels are configured, they are read in that mode
+
+void statusBegin() {
+
+  for (int i = 1; i <= 8; i++) status_dig_state[i] = Indio.digitalRead(i);
+
+  statusListen();
+  SerialUSB.print("[STATUS] server started on port ");
+  SerialUSB.println(STATUS_PORT);
+
+  // render a complete first snapshot so the front buffer is never empty
+  do statusRender();
+  while (status_section != 0);
+  status_loop_last_ts = micros();
+}
+
+///////////////////////////////////////////////////////////////////////
+// call from loop(), returns within about STATUS_BUDGET_US
+// except once per STATUS_ANALOG_INTERVAL_MS, after the analog read (see the top of this tab)
+
+void statusCheck() {
+
+  unsigned long start_us = micros();
+
+  statusListen();  // new connections are accepted and wait in their own socket
+  statusSweep();
+
+  if (statusSample()) return;
+  statusRender();
+
+  while (micros() - start_us < STATUS_BUDGET_US) {
+    if (!statusServeStep()) break;
+  }
+}
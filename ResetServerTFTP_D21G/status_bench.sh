@@ -0,0 +1,76 @@
+#!/bin/bash
+# Industruino D21G status server benchmark
+# this script takes 1 to 4 arguments:
+# 1. the IP address of the Industruino
+# 2. the number of requests (default 500)
+# 3. the requests per second, in total (default 5)
+# 4. the number of parallel clients (default 1)
+# this script does:
+# > requests /status and /metrics alternately at a fixed rate, from 1 or more clients at the same time
+# > prints the p50/p99/max response time of the successful requests measured by curl, and the failed requests
+# > prints the latency histogram and loop timing measured by the Industruino itself
+# status port assumed is '80'
+
+if [ $# -lt 1 ] || [ $# -gt 4 ]
+then
+	echo "ERROR: script needs 1 to 4 arguments: Industruino IP address [requests] [requests per second] [clients]"
+	exit 1
+fi
+
+COUNT=${2:-500}
+RATE=${3:-5}
+CLIENTS=${4:-1}
+INTERVAL=$(awk "BEGIN { print $CLIENTS / $RATE }")   # per client
+TIMES=$(mktemp)
+IP=$1
+
+# one client: requests i, i+CLIENTS, i+2*CLIENTS.. and writes exactly one line per request:
+# time_total in seconds, or FAIL (curl prints time_total also when the request fails)
+client() {
+	for ((i = $1; i < COUNT; i += CLIENTS))
+	do
+		if [ $((i % 2)) == 0 ]; then URL="http://$IP/status"; else URL="http://$IP/metrics"; fi
+		T=$(curl -s -o /dev/null --max-time 5 -w "%{time_total}" "$URL")
+		if [ $? -eq 0 ]; then echo "$T" >> $TIMES; else echo "FAIL" >> $TIMES; fi
+		sleep $INTERVAL
+	done
+}
+
+echo "+++++++++++++++++++++++++++++++++++++"
+echo "Benchmark of Industruino status server:"
+echo "+++++++++++++++++++++++++++++++++++++"
+echo "http://$1/status and http://$1/metrics, $COUNT requests at $RATE per second from $CLIENTS clients"
+
+for ((c = 0; c < CLIENTS; c++))
+do
+	client $c &   # all clients at the same time, to test concurrent connections
+done
+wait
+
+echo ""
+echo "++++++++++++++++++++++++++"
+echo "Response time (client):"
+echo "++++++++++++++++++++++++++"
+grep -v FAIL $TIMES | sort -n | awk -v total=$(wc -l < $TIMES) '
+	{ t[NR] = $1 * 1000 }
+	END {
+		printf "requests: %d  failed: %d\n", total, total - NR
+		if (NR == 0) exit
+		# nearest rank percentiles of the successful requests
+		i50 = int(NR * 0.50); if (i50 < NR * 0.50) i50++
+		i99 = int(NR * 0.99); if (i99 < NR * 0.99) i99++
+		printf "p50: %.1f ms  p99: %.1f ms  max: %.1f ms\n", t[i50], t[i99], t[NR]
+	}'
+rm -f $TIMES
+
+echo ""
+echo "++++++++++++++++++++++++++"
+echo "Response time (Industruino):"
+echo "++++++++++++++++++++++++++"
+curl -s "http://$1/metrics" | grep -E "^indio_(http|loop)"
+curl -s "http://$1/status" | grep -o '"http":{[^}]*}'
+echo ""
+
+echo "++++++++++++++++++++++++++"
+
+exit 0
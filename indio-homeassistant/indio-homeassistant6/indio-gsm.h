@@ -1,3 +1,261 @@
 /*
   GSM functions for Industruino
+  for metered cellular data: all channels are sent in one aggregated state message per report interval,
+  instead of one topic per channel, and Home Assistant decodes it with a value template per entity
+
+  state topic: indio/indio_mac (retained)
+  payload: JSON with short keys, about 80 bytes
+    {"d":166,"c":[12,0,3,0],"a":[12.50,0.00,0.00,99.80],"o":[50.00,0.00],"b":10432}
+    d: digital ch1-8 as bits (bit 0 = ch1), c: pulse counters ch1-4, a: analog inputs ch1-4 (%),
+    o: analog outputs ch1-2 (%), b: bytes used today (see below)
+  a binary payload would be smaller, but Home Assistant applies "encoding":"" to the availability topic too,
+  so the entities would stay unavailable
+
+  between reports the modem is put in sleep mode (AT+CSCLK=2), the GPRS and MQTT connections stay up
+  the modem is woken up every GSM_POLL_INTERVAL_SEC to receive MQTT commands, this uses no cellular data
+  the MQTT keep-alive is raised from the default 15s to GSM_MQTT_KEEPALIVE_SEC, so there is one PINGREQ/PINGRESP
+  per keep-alive period instead of 4 per minute, the reports keep the connection alive at the broker
+  the mqtt_server must be reachable from the internet, homeassistant.local only works on the local network
+
+  bytes used are counted at the MQTT client, plus an estimate of the TCP/IP headers of every packet sent,
+  per 24h since startup, the real use billed by the operator is a bit higher (TCP acks, retransmissions)
+
+  Library needed:
+  > TinyGSM: https://github.com/vshymanskyy/TinyGSM
 */
+
+/////////////// GSM CONFIG PARAMETERS ///////////////////////////////////////////////////////////////
+const char gsm_apn[] = "YourAPN";
+const char gsm_user[] = "";                      // leave empty if not needed
+const char gsm_pass[] = "";
+const int GSM_PWR_PIN = -1;                      // older GSM modules need a 1s pulse on D6 to switch on, but D6 is also FRAM_CS1
+const int GSM_REPORT_INTERVAL_SEC = 300;         // one aggregated state message per interval
+const int GSM_POLL_INTERVAL_SEC = 30;            // wake up the modem to handle MQTT commands
+const unsigned long GSM_POLL_WINDOW_MS = 1000;   // modem awake per poll, to receive the queued MQTT commands
+const int GSM_MQTT_KEEPALIVE_SEC = 2 * GSM_REPORT_INTERVAL_SEC;  // lower this if the operator drops idle connections
+const int GSM_TCPIP_OVERHEAD = 40;               // estimated IP + TCP header bytes per packet
+const int GSM_CONNECT_TIMEOUT_SEC = 30;          // TCP connect to the MQTT server, TinyGSM default is 75s
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// state topic and value template for the Home Assistant config of one entity
+// field: 'd' digital, 'c' counter, 'a' analog input, 'o' analog output, 'b' bytes today
+// used by publishConfig() for all communication modules, only gsm uses the aggregated state message
+
+String gsmStateConfig(String state_topic, char field, int ch) {
+
+  if (COMM_MODULE != 2) return "\"state_topic\":\"" + state_topic + "\",";
+
+  String tpl;
+  switch (field) {
+    case 'd': tpl = "{{ 'ON' if value_json.d | bitwise_and(" + String(1 << (ch - 1)) + ") else 'OFF' }}"; break;
+    case 'c': tpl = "{{ value_json.c[" + String(ch - 1) + "] }}"; break;
+    case 'a': tpl = "{{ value_json.a[" + String(ch - 1) + "] }}"; break;
+    case 'o': tpl = "{{ value_json.o[" + String(ch - 1) + "] }}"; break;
+    case 'b': tpl = "{{ value_json.b }}"; break;
+  }
+  return "\"state_topic\":\"indio/" + indio_mac + "\",\"value_template\":\"" + tpl + "\",";
+}
+
+// state
+bool gsm_report_now = false;                     // set by an MQTT command, to acknowledge the new state
+unsigned long gsm_report_ts;
+unsigned long gsm_poll_ts;
+unsigned long gsm_wake_ts;                       // start of the poll window
+
+// data use
+unsigned long gsm_bytes_today;
+unsigned long gsm_bytes_yesterday;
+unsigned long gsm_day_start_ts;
+
+void gsmCountBytes(unsigned long n) {
+  // 24h periods since startup, there is no clock in this sketch
+  while (millis() - gsm_day_start_ts >= 86400000UL) {
+    gsm_day_start_ts += 86400000UL;
+    gsm_bytes_yesterday = gsm_bytes_today;
+    gsm_bytes_today = 0;
+    SerialUSB.print("[GSM] bytes used in the last 24h: ");
+    SerialUSB.println(gsm_bytes_yesterday);
+  }
+  gsm_bytes_today += n;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// everything below needs the TinyGSM library, only compiled for the gsm module
+
+#if COMM_MODULE == 2
+
+#define TINY_GSM_MODEM_SIM800
+#include <TinyGsmClient.h>
+#define SerialAT Serial1
+
+TinyGsm modem(SerialAT);
+#if USE_SSL == 1
+TinyGsmClientSecure gsm_tcp_client(modem);
+#else
+TinyGsmClient gsm_tcp_client(modem);
+#endif
+
+bool gsm_sleeping = false;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// MQTT client over the GSM client that counts the bytes sent and received
+// and connects with a shorter timeout, to stay within the watchdog time
+
+class GsmCountingClient : public Client {
+public:
+  GsmCountingClient(TinyGsmClient &c)
+    : client(c) {}
+  int connect(IPAddress ip, uint16_t port) {
+    gsmCountBytes(3 * GSM_TCPIP_OVERHEAD);  // TCP handshake
+    return client.connect(ip, port, GSM_CONNECT_TIMEOUT_SEC);
+  }
+  int connect(const char *host, uint16_t port) {
+    gsmCountBytes(3 * GSM_TCPIP_OVERHEAD);  // TCP handshake
+    return client.connect(host, port, GSM_CONNECT_TIMEOUT_SEC);
+  }
+  size_t write(uint8_t b) {
+    gsmCountBytes(1 + GSM_TCPIP_OVERHEAD);
+    return client.write(b);
+  }
+  size_t write(const uint8_t *buf, size_t size) {
+    gsmCountBytes(size + GSM_TCPIP_OVERHEAD);  // one packet per write with TinyGSM
+    return client.write(buf, size);
+  }
+  int available() {
+    return client.available();
+  }
+  int read() {
+    int c = client.read();
+    if (c >= 0) gsmCountBytes(1);
+    return c;
+  }
+  int read(uint8_t *buf, size_t size) {
+    int n = client.read(buf, size);
+    if (n > 0) gsmCountBytes(n);
+    return n;
+  }
+  int peek() {
+    return client.peek();
+  }
+  void flush() {
+    client.flush();
+  }
+  void stop() {
+    client.stop();
+  }
+  uint8_t connected() {
+    return client.connected();
+  }
+  operator bool() {
+    return client;
+  }
+private:
+  TinyGsmClient &client;  // also TinyGsmClientSecure, derived from it
+};
+
+GsmCountingClient gsm_client(gsm_tcp_client);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// attach to the network and open the GPRS connection, if not connected yet
+
+bool gsmConnect() {
+
+  if (!modem.isNetworkConnected()) {
+    SerialUSB.print("[GSM] waiting for network..");
+    if (!modem.waitForNetwork(60000L)) {
+      SerialUSB.println(" fail");
+      return false;
+    }
+    SerialUSB.println(" OK");
+  }
+  myWDT.clear();  // network and GPRS can each take up to a minute
+  if (!modem.isGprsConnected()) {
+    SerialUSB.print("[GSM] connecting to APN ");
+    SerialUSB.print(gsm_apn);
+    if (!modem.gprsConnect(gsm_apn, gsm_user, gsm_pass)) {
+      SerialUSB.println(" fail");
+      return false;
+    }
+    SerialUSB.println(" OK");
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// sleep mode 2: the modem sleeps when its serial port is idle, network and GPRS stay connected
+// the first character after sleep wakes it up and is lost, so keep sending AT until OK
+
+void gsmSleep() {
+  modem.sendAT(GF("+CSCLK=2"));
+  modem.waitResponse();
+  gsm_sleeping = true;
+}
+
+void gsmWake() {
+  if (!gsm_sleeping) return;
+  modem.testAT(5000);
+  modem.sendAT(GF("+CSCLK=0"));
+  modem.waitResponse();
+  gsm_sleeping = false;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+void initGSM() {
+
+  SerialUSB.println("[GSM] run initGSM()..");
+
+  lcd.clear();
+  lcd.setCursor(0, 0);
+  lcd.print("[GSM] init");
+
+  // switch on the modem if needed
+  if (GSM_PWR_PIN >= 0) {
+    pinMode(GSM_PWR_PIN, OUTPUT);
+    digitalWrite(GSM_PWR_PIN, HIGH);
+    delay(1000);
+    digitalWrite(GSM_PWR_PIN, LOW);
+  }
+
+  SerialAT.begin(115200);
+  delay(3000);
+  SerialUSB.println("[GSM] initializing modem..");
+  lcd.setCursor(0, 1);
+  lcd.print("modem restart..");
+  modem.restart();
+  String modem_info = modem.getModemInfo();
+  SerialUSB.print("[GSM] modem: ");
+  SerialUSB.println(modem_info);
+  lcd.setCursor(0, 2);
+  lcd.print(modem_info.substring(0, 21));
+
+  // unlock your SIM card with a PIN if needed
+  //modem.simUnlock("1234");
+
+  lcd.setCursor(0, 3);
+  lcd.print("network, GPRS..");
+  lcd.setCursor(0, 4);
+  if (gsmConnect()) {
+    lcd.print("OK");
+    SerialUSB.print("[GSM] IP address: ");
+    SerialUSB.println(modem.localIP());
+    lcd.setCursor(0, 5);
+    lcd.print("IP ");
+    lcd.print(modem.localIP());
+  } else {
+    lcd.print("failed, retry later");
+  }
+  int csq = modem.getSignalQuality();
+  SerialUSB.print("[GSM] signal quality (0-31): ");
+  SerialUSB.println(csq);
+  lcd.setCursor(0, 6);
+  lcd.print("signal: ");
+  lcd.print(csq);
+  lcd.print("/31");
+
+  gsm_day_start_ts = millis();
+  delay(1500);  // for displaying
+}
+
+#endif
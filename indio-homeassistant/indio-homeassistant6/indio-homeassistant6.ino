@@ -1,7 +1,8 @@
 /*
   Industruino INDIO HomeAssistant (HASS) generic sketch
   using communication module:
-  wifi or ethernet (or gsm - not implemented yet)
+  wifi, ethernet or gsm
+  with gsm all channels are sent in one aggregated state message per report interval, to save cellular data (see indio-gsm.h)
 
   connects to HASS over MQTT https://www.home-assistant.io/integrations/mqtt/
   discovered by HASS using MQTT Discovery https://www.home-assistant.io/integrations/mqtt/#mqtt-discovery
@@ -24,6 +25,7 @@
   handles MQTT callbacks with set commands for digital and analog outputs
   reads digital channels (1-8) and publishes state if changed
   reads analog channels (1-4) and publishes value if changed (at certain interval)
+  gsm: wakes up the modem at interval for MQTT commands, publishes the aggregated state message at report interval
 
   CONFIGURATION in HOME ASSISTANT by MQTT DISCOVERY (retained):
   during normal operation, press UP button, then DOWN button, to publish the configuration
@@ -116,6 +118,8 @@ unsigned long last_display_ts;
 PubSubClient mqtt_client(wifi_client);
 #elif COMM_MODULE == 1
 PubSubClient mqtt_client(eth_client);
+#elif COMM_MODULE == 2
+PubSubClient mqtt_client(gsm_client);
 #endif
 // use standard MQTT ports
 #if USE_SSL == 1
@@ -154,6 +158,9 @@ void setup() {
   // join the network
   if (COMM_MODULE == 0) initWifi();
   if (COMM_MODULE == 1) initEthernet();
+#if COMM_MODULE == 2
+  initGSM();
+#endif
   myWDT.clear();
 
   // MQTT settings and initial connect
@@ -162,6 +169,10 @@ void setup() {
   //mqtt_client.setKeepAlive(60);  // default 15
   //mqtt_client.setSocketTimeout(60);  // default 15
   mqtt_client.setBufferSize(1024);  // default 256, was 512
+#if COMM_MODULE == 2
+  mqtt_client.setKeepAlive(GSM_MQTT_KEEPALIVE_SEC);  // fewer PINGREQ/PINGRESP on cellular data
+  mqtt_client.setSocketTimeout(30);                   // higher latency on cellular
+#endif
   //wifi_client.setCACert(mqtt_ssl_cert);  // set SSL certificate
   mqttConnect();
 
@@ -175,6 +186,12 @@ void setup() {
   readAnalogChannels(true);    // do force_publish on startup
   publishPulseCounters(true);  // do force_publish on startup
   //writeAnalogChannels();          // not necessary to set the output value, wait for retained mqtt message
+  if (COMM_MODULE == 2) {
+    publishState();  // gsm: one aggregated state message instead of the channel topics above
+    gsm_report_ts = millis();
+    gsm_poll_ts = millis();
+    gsm_wake_ts = millis();  // the modem is awake after initGSM(), the first loops are a poll window
+  }
 
   SerialUSB.println();
   SerialUSB.println("===============================");
@@ -194,6 +211,40 @@ void loop() {
 
   myWDT.clear();  // watchdog reset
 
+#if COMM_MODULE == 2
+  // gsm: the modem sleeps between polls, wake it up at interval to handle MQTT commands
+  // and publish the aggregated state at report interval, or after a command
+  // the poll window is handled one mqtt_client.loop() per loop(), so the inputs are still read every loop
+  if (gsm_sleeping && (gsm_report_now || millis() - gsm_poll_ts > GSM_POLL_INTERVAL_SEC * 1000UL)) {
+    gsmWake();
+    if (!mqtt_client.connected() && millis() - last_mqtt_attempt_ts > MQTT_RECONNECT_INTERVAL_SEC * 1000) {
+      // blocking: pulses during the reconnect are missed, only between the steps the inputs are read
+      readDigitalChannels(false);
+      if (gsmConnect()) {  // network or GPRS may have dropped
+        myWDT.clear();     // gsmConnect() can take up to 2 minutes, mqttConnect() up to GSM_CONNECT_TIMEOUT_SEC
+        readDigitalChannels(false);
+        mqttConnect();
+      }
+      last_mqtt_attempt_ts = millis();
+      displayMain();  // restore fixed items display
+    }
+    gsm_wake_ts = millis();
+  }
+  if (!gsm_sleeping) {
+    mqtt_client.loop();  // receive the commands queued since the last poll
+    if (millis() - gsm_wake_ts > GSM_POLL_WINDOW_MS) {
+      if (gsm_report_now || millis() - gsm_report_ts > GSM_REPORT_INTERVAL_SEC * 1000UL) {
+        readDigitalChannels(false);  // include the outputs just switched by a command
+        readAnalogChannels(false);
+        publishState();
+        gsm_report_ts = millis();
+        gsm_report_now = false;
+      }
+      gsmSleep();
+      gsm_poll_ts = millis();
+    }
+  }
+#else
   mqtt_client.loop();  // handle MQTT connection
 
   // if MQTT connection lost, try to connect at intervals
@@ -202,6 +253,7 @@ void loop() {
     last_mqtt_attempt_ts = millis();
     displayMain();  // restore fixed items display
   }
+#endif
 
   // read digital channels every loop
   readDigitalChannels(false);  // do not force_publish, publish if changed
@@ -390,6 +442,7 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
         SerialUSB.print(this_channel);
         SerialUSB.println(" OFF");
       } else SerialUSB.println("[MQTT] payload invalid, ignore");
+      gsm_report_now = true;  // gsm: acknowledge with the aggregated state message
     }
     // do not acknowledge by publishing to the /state topic, will be done in loop
   }
@@ -409,6 +462,8 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
       dig_in_pulse_counter[this_channel] = set_value;
       SerialUSB.print("> [FRAM] update stored counter value");
       writeFRAMulong(FRAM_COUNTER_ADDRESS_START + (this_channel - 1) * 4, set_value);
+      gsm_report_now = true;  // gsm: acknowledge with the aggregated state message
+      if (COMM_MODULE == 2) return;
       // acknowledge with update of the value topic
       String this_topic = "homeassistant/number/" + indio_mac + "_counter_d" + String(this_channel);
       String state_topic = this_topic + "/value";
@@ -441,7 +496,9 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
         SerialUSB.print(set_value, 2);
         SerialUSB.println("%");
         ana_out_ch_current_value[this_channel] = set_value;  // remember the value for display
-                                                             // acknowledge with update of the value topic
+        gsm_report_now = true;                               // gsm: acknowledge with the aggregated state message
+        if (COMM_MODULE == 2) return;
+        // acknowledge with update of the value topic
         String this_topic = "homeassistant/number/" + indio_mac + "_ao" + String(this_channel);
         String state_topic = this_topic + "/value";
         String this_payload = String(set_value, 2);
@@ -465,6 +522,7 @@ void publishConfig() {
 
   // use MQTT discovery feature https://www.home-assistant.io/integrations/mqtt/#mqtt-discovery
   // TO DO we could use abbreviations to reduce the payload size https://www.home-assistant.io/integrations/mqtt/#discovery-payload
+  // gsm: all entities use the aggregated state topic, with a value template to decode their channel (gsmStateConfig)
 
   lcd.setCursor(0, 7);
   lcd.print("sending config..");
@@ -486,7 +544,7 @@ void publishConfig() {
     // create config payload
     String this_payload = "{\"name\":\"" + this_entity + "\",";  // can use abbreviations https://www.home-assistant.io/integrations/mqtt/#discovery-payload
     this_payload += "\"unique_id\":\"" + this_entity + "\",";
-    this_payload += "\"state_topic\":\"" + state_topic + "\",";
+    this_payload += gsmStateConfig(state_topic, 'd', i);
     this_payload += general_config_payload;
     this_payload += "}";
     SerialUSB.print("[MQTT] publish on topic: ");
@@ -512,7 +570,7 @@ void publishConfig() {
     // create config payload
     String this_payload = "{\"name\":\"" + this_entity + "\",";  // can use abbreviations https://www.home-assistant.io/integrations/mqtt/#discovery-payload
     this_payload += "\"unique_id\":\"" + this_entity + "\",";
-    this_payload += "\"state_topic\":\"" + state_topic + "\",";
+    this_payload += gsmStateConfig(state_topic, 'c', i);
     this_payload += "\"command_topic\":\"" + command_topic + "\",";
     //    this_payload += "\"retain\":\"true\",";  // to receive the latest set value on startup, but we want to use FRAM stored counters
     this_payload += "\"max\":\"10000000\",";  // default is 100.0
@@ -542,7 +600,7 @@ void publishConfig() {
     // create config payload
     String this_payload = "{\"name\":\"" + this_entity + "\",";
     this_payload += "\"unique_id\":\"" + this_entity + "\",";
-    this_payload += "\"state_topic\":\"" + state_topic + "\",";
+    this_payload += gsmStateConfig(state_topic, 'd', i);
     this_payload += "\"command_topic\":\"" + command_topic + "\",";
     this_payload += "\"retain\":\"true\",";  // to receive the latest value on startup
     this_payload += general_config_payload;
@@ -569,7 +627,7 @@ void publishConfig() {
     // create config payload
     String this_payload = "{\"name\":\"" + this_entity + "\",";
     this_payload += "\"unique_id\":\"" + this_entity + "\",";
-    this_payload += "\"state_topic\":\"" + state_topic + "\",";
+    this_payload += gsmStateConfig(state_topic, 'a', i);
     this_payload += "\"unit_of_measurement\":\"%\",";
     this_payload += general_config_payload;
     this_payload += "}";
@@ -596,7 +654,7 @@ void publishConfig() {
     // create config payload
     String this_payload = "{\"name\":\"" + this_entity + "\",";
     this_payload += "\"unique_id\":\"" + this_entity + "\",";
-    this_payload += "\"state_topic\":\"" + state_topic + "\",";
+    this_payload += gsmStateConfig(state_topic, 'o', i);
     this_payload += "\"command_topic\":\"" + command_topic + "\",";
     this_payload += "\"retain\":\"true\",";  // to receive the latest value on startup
     this_payload += "\"unit_of_measurement\":\"%\",";
@@ -613,6 +671,28 @@ void publishConfig() {
     }
     delay(1000);  // allow HASS to process the new entity/device
   }
+
+  // GSM: cellular data used today = "sensor"
+  if (COMM_MODULE == 2) {
+    lcd.print(".");
+    String this_entity = indio_mac + "_gsm_bytes";
+    String config_topic = "homeassistant/sensor/" + this_entity + "/config";
+    String this_payload = "{\"name\":\"" + this_entity + "\",";
+    this_payload += "\"unique_id\":\"" + this_entity + "\",";
+    this_payload += gsmStateConfig("", 'b', 0);
+    this_payload += "\"unit_of_measurement\":\"B\",";
+    this_payload += general_config_payload;
+    this_payload += "}";
+    SerialUSB.print("[MQTT] publish on topic: ");
+    SerialUSB.print(config_topic);
+    SerialUSB.print(" payload: ");
+    SerialUSB.print(this_payload);
+    if (mqtt_client.publish(config_topic.c_str(), this_payload.c_str(), 1)) {  // retain
+      SerialUSB.println(" [OK]");
+    } else {
+      SerialUSB.println(" [FAIL]");
+    }
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -639,6 +719,10 @@ void readDigitalChannels(bool force_publish) {
           SerialUSB.println(dig_in_pulse_counter[i]);
         }
       }
+      if (COMM_MODULE == 2) {  // gsm: sent in the aggregated state message
+        dig_ch_prev_state[i] = dig_ch_now_state;
+        continue;
+      }
       String this_topic;
       if (i < 5) this_topic = "homeassistant/binary_sensor/" + indio_mac;  // ch1-4
       else this_topic = "homeassistant/switch/" + indio_mac;               // ch5-8
@@ -674,6 +758,10 @@ void readAnalogChannels(bool force_publish) {
         SerialUSB.print("[INDIO] changed value detected on analog channel ");
         SerialUSB.println(i);
       }
+      if (COMM_MODULE == 2) {  // gsm: sent in the aggregated state message
+        ana_in_ch_prev_value[i] = ana_ch_now_value;
+        continue;
+      }
       String this_topic = "homeassistant/sensor/" + indio_mac + "_ai" + String(i);
       String state_topic = this_topic + "/value";
       String this_payload = String(ana_ch_now_value, 2);
@@ -712,6 +800,7 @@ void publishPulseCounters(bool force_publish) {
         SerialUSB.println(dig_in_pulse_counter[i]);
         writeFRAMulong(FRAM_COUNTER_ADDRESS_START + (i - 1) * 4, dig_in_pulse_counter[i]);
       }
+      if (COMM_MODULE == 2) continue;  // gsm: sent in the aggregated state message
       String this_topic = "homeassistant/number/" + indio_mac + "_counter_d" + String(i);
       String state_topic = this_topic + "/value";
       String this_payload = String(dig_in_pulse_counter[i]);
@@ -728,6 +817,35 @@ void publishPulseCounters(bool force_publish) {
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+
+void publishState() {
+
+  // gsm: all channels in one retained message, decoded by the value templates of publishConfig()
+  // JSON with short keys, see indio-gsm.h
+  byte dig_bits = 0;
+  for (int i = 1; i <= 8; i++) {
+    if (dig_ch_prev_state[i]) dig_bits |= 1 << (i - 1);
+  }
+  String state_topic = "indio/" + indio_mac;
+  SerialUSB.print("> [MQTT] publish state on topic: ");
+  SerialUSB.print(state_topic);
+  SerialUSB.print(" payload: ");
+  String this_payload = "{\"d\":" + String(dig_bits) + ",\"c\":[";
+  for (int i = 1; i <= 4; i++) this_payload += String(dig_in_pulse_counter[i]) + (i < 4 ? "," : "],\"a\":[");
+  for (int i = 1; i <= 4; i++) this_payload += String(ana_in_ch_prev_value[i], 2) + (i < 4 ? "," : "],\"o\":[");
+  for (int i = 1; i <= 2; i++) this_payload += String(ana_out_ch_current_value[i], 2) + (i < 2 ? "," : "],\"b\":");
+  this_payload += String(gsm_bytes_today) + "}";
+  SerialUSB.print(this_payload);
+  if (mqtt_client.publish(state_topic.c_str(), this_payload.c_str(), 1)) {  // retain
+    SerialUSB.println(" [OK]");
+  } else {
+    SerialUSB.println(" [FAIL]");
+  }
+  SerialUSB.print("[GSM] bytes used today: ");
+  SerialUSB.println(gsm_bytes_today);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /*
 void writeAnalogChannels() {  // could also be done in configIO() but better here for symmetry
@@ -865,7 +983,14 @@ void handleButtons() {
       if (!digitalRead(DOWN_PIN)) {  // press DOWN button
         SerialUSB.println("[BUTTON] DOWN pressed");
         SerialUSB.println("[MQTT] SEND CONFIGURATION OF ENTITIES TO HOME ASSISTANT");
+#if COMM_MODULE == 2
+        bool was_sleeping = gsm_sleeping;  // not during a poll window
+        gsmWake();                         // the modem loses the first character after sleep, wake it before using mqtt_client
         publishConfig();
+        if (was_sleeping) gsmSleep();
+#else
+        publishConfig();
+#endif
       }
     }
     SerialUSB.println("[BUTTON] UP released");